@@ -10,6 +10,9 @@ extern "C" {
 
 #define __NEED_float_t
 #define __NEED_double_t
+#ifdef _GNU_SOURCE
+#define __NEED_size_t
+#endif
 #include <bits/alltypes.h>
 
 #if 100*__GNUC__+__GNUC_MINOR__ >= 303
@@ -20,6 +23,19 @@ extern "C" {
 #define INFINITY  1e5000f
 #endif
 
+/* x86_64 provides vector-ABI variants of a few functions; like glibc,
+ * advertise them only under -ffast-math as they do not set errno. */
+#if defined(__x86_64__) && !defined(__ILP32__) && defined(__FAST_MATH__)
+#if defined(_OPENMP) && _OPENMP >= 201307
+#define __MATH_SIMD _Pragma("omp declare simd notinbranch")
+#elif __GNUC__ >= 6 && !defined(__clang__)
+#define __MATH_SIMD __attribute__((__simd__("notinbranch")))
+#endif
+#endif
+#ifndef __MATH_SIMD
+#define __MATH_SIMD
+#endif
+
 #define HUGE_VALF INFINITY
 #define HUGE_VAL  ((double)INFINITY)
 #define HUGE_VALL ((long double)INFINITY)
@@ -189,12 +205,12 @@ double      erfc(double);
 float       erfcf(float);
 long double erfcl(long double);
 
-double      exp(double);
-float       expf(float);
+__MATH_SIMD double exp(double);
+__MATH_SIMD float expf(float);
 long double expl(long double);
 
-double      exp2(double);
-float       exp2f(float);
+__MATH_SIMD double exp2(double);
+__MATH_SIMD float exp2f(float);
 long double exp2l(long double);
 
 double      expm1(double);
@@ -427,6 +443,10 @@ void        sincos(double, double*, double*);
 void        sincosf(float, float*, float*);
 void        sincosl(long double, long double*, long double*);
 
+double      sinpi(double);
+double      cospi(double);
+void        sincospi(double, double*, double*);
+
 double      exp10(double);
 float       exp10f(float);
 long double exp10l(long double);
@@ -434,6 +454,10 @@ long double exp10l(long double);
 double      pow10(double);
 float       pow10f(float);
 long double pow10l(long double);
+
+void        vexpf(float *, const float *, size_t);
+void        vlogf(float *, const float *, size_t);
+void        vsincosf(float *, float *, const float *, size_t);
 #endif
 
 #ifdef __cplusplus
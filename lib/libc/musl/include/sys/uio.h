@@ -17,6 +17,7 @@ extern "C" {
 
 #ifdef _GNU_SOURCE
 #define __NEED_pid_t
+#define __NEED_FILE
 #endif
 
 #include <bits/alltypes.h>
@@ -39,6 +40,7 @@ ssize_t pwritev (int, const struct iovec *, int, off_t);
 #ifdef _GNU_SOURCE
 ssize_t process_vm_writev(pid_t, const struct iovec *, unsigned long, const struct iovec *, unsigned long, unsigned long);
 ssize_t process_vm_readv(pid_t, const struct iovec *, unsigned long, const struct iovec *, unsigned long, unsigned long);
+size_t fwritev(FILE *__restrict, const struct iovec *, int);
 #endif
 
 #ifdef __cplusplus
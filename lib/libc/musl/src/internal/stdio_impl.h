@@ -46,6 +46,7 @@ struct _IO_FILE {
 	off_t shlim, shcnt;
 	FILE *prev_locked, *next_locked;
 	struct __locale_struct *locale;
+	FILE *pipe_prev, *pipe_next;
 };
 
 extern hidden FILE *volatile __stdin_used;
@@ -86,6 +87,8 @@ hidden FILE *__ofl_add(FILE *f);
 hidden FILE **__ofl_lock(void);
 hidden void __ofl_unlock(void);
 
+hidden void __popen_unlink(FILE *);
+
 struct __pthread;
 hidden void __register_locked_file(FILE *, struct __pthread *);
 hidden void __unlist_locked_file(FILE *);
@@ -0,0 +1,42 @@
+#include "libm.h"
+
+/*
+ * Reduction for the trig functions of pi*x: for finite |x| < 2**52
+ * returns n and y[0]+y[1] such that pi*x = n*pi/2 + y[0]+y[1] with
+ * |y[0]+y[1]| <= pi/4. The reduction of x itself is exact, so unlike
+ * __rem_pio2 no multi-word approximation of pi is needed; only the
+ * final product pi*r is formed in double-double arithmetic.
+ */
+
+static const double
+pi_hi = 3.14159262180328369141e+00, /* 0x400921FB, 0x50000000 */
+pi_mi = 3.17865094245917129644e-08, /* 0x3E6110B4, 0x60000000 */
+pi_lo = 1.22464679914735317723e-16; /* 0x3CA1A626, 0x33145C07 */
+
+int __rem_pi(double x, double *y)
+{
+	double t, r, rh, rl, p, e;
+	int64_t q;
+
+	/* 2*x and 2*x-q are exact, so r = x - q/2 is exact and |r| <= 1/4 */
+	t = 2*x;
+	q = t;
+	t -= q;
+	if (t > 0.5) {
+		q++;
+		t -= 1;
+	} else if (t < -0.5) {
+		q--;
+		t += 1;
+	}
+	r = 0.5*t;
+
+	/* y = pi*r, with the high parts of the product computed exactly */
+	rh = asdouble(asuint64(r) & -1ULL<<27);
+	rl = r - rh;
+	p = r*(pi_hi + pi_mi);
+	e = rh*pi_hi - p + rh*pi_mi + rl*pi_hi + rl*pi_mi + r*pi_lo;
+	y[0] = p + e;
+	y[1] = p - y[0] + e;
+	return q;
+}
@@ -0,0 +1,33 @@
+#define _GNU_SOURCE
+#include "libm.h"
+
+/* cos(pi*x) without the Payne-Hanek path: the reduction is exact */
+
+double cospi(double x)
+{
+	double y[2];
+	uint32_t ix, lx;
+	unsigned n;
+
+	EXTRACT_WORDS(ix, lx, x);
+	ix &= 0x7fffffff;
+
+	/* cospi(Inf or NaN) is NaN */
+	if (ix >= 0x7ff00000)
+		return x - x;
+	/* |x| >= 2**52 is an integer, odd only below 2**53 */
+	if (ix >= 0x43300000)
+		return ix < 0x43400000 && lx&1 ? -1.0 : 1.0;
+
+	n = __rem_pi(x, y);
+	/* cospi(n+1/2) = +0 */
+	if (y[0] == 0 && n&1)
+		return 0.0;
+	switch (n&3) {
+	case 0: return  __cos(y[0], y[1]);
+	case 1: return -__sin(y[0], y[1], 1);
+	case 2: return -__cos(y[0], y[1]);
+	default:
+		return  __sin(y[0], y[1], 1);
+	}
+}
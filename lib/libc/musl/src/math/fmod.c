@@ -38,7 +38,31 @@ double fmod(double x, double y)
 		uy.i |= 1ULL << 52;
 	}
 
-	/* x mod y */
+	/* x mod y: gaps of up to 2 bits are cheapest with the shift and
+	 * subtract loop below. Larger ones reduce up to 10 bits per step:
+	 * the quotient of the shifted remainder by y is estimated with a
+	 * reciprocal multiply, which is off by at most one, and the
+	 * remainder is fixed up in integer arithmetic, so no integer
+	 * division is needed. */
+	if (ex - ey > 2) {
+		double_t inv = 1.0 / (int64_t)uy.i;
+		uint64_t n;
+		int d, q;
+
+		do {
+			d = ex - ey < 10 ? ex - ey : 10;
+			n = uxi << d;
+			q = (int64_t)n * inv;
+			uxi = n - q*uy.i;
+			if ((int64_t)uxi < 0)
+				uxi += uy.i;
+			else if (uxi >= uy.i)
+				uxi -= uy.i;
+			ex -= d;
+		} while (ex > ey);
+		if (uxi == 0)
+			return 0*x;
+	}
 	for (; ex > ey; ex--) {
 		i = uxi - uy.i;
 		if (i >> 63 == 0) {
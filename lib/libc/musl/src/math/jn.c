@@ -39,6 +39,74 @@
 
 static const double invsqrtpi = 5.64189583547756279280e-01; /* 0x3FE20DD7, 0x50429B6D */
 
+/*
+ * Hankel's asymptotic expansion for x >> n**2, with m = 4n**2:
+ *      Jn(x) = sqrt(2/(x*pi))*(P*cos(xn) - Q*sin(xn))
+ *      Yn(x) = sqrt(2/(x*pi))*(P*sin(xn) + Q*cos(xn))
+ *      P = 1 - (m-1)(m-9)/(2!(8x)**2) + (m-1)(m-9)(m-25)(m-49)/(4!(8x)**4) - ...
+ *      Q = (m-1)/(8x) - (m-1)(m-9)(m-25)/(3!(8x)**3) + ...
+ * where xn = x-(2n+1)*pi/4. The series diverges, so it is only used
+ * if its terms drop below 2**-56 before they start growing. This replaces
+ * j0, j1 (or y0, y1) and the O(n) recurrence by a few multiply-adds,
+ * sin(x), cos(x) and cos(2x). Returns 0 if the expansion cannot be used.
+ */
+static int hankel(int nm1, double x, double *r, int y)
+{
+	double m, z, t, u, p, q, s, c, ss, cc, w;
+	int k;
+
+	if (x < 80.0 || (nm1+1.0)*(nm1+1.0) > x)
+		return 0;
+	m = 4*(nm1+1.0)*(nm1+1.0);
+	z = 8*x;
+	p = 1.0;
+	q = t = (m-1)/z;
+	for (k = 2; fabs(t) >= 0x1p-56; k++) {
+		u = t*(m-(2*k-1.0)*(2*k-1.0))/(k*z);
+		if (k > 40 || fabs(u) >= fabs(t))
+			return 0;
+		t = u;
+		if (k & 1)
+			q += k & 2 ? -t : t;
+		else
+			p += k & 2 ? -t : t;
+	}
+	/*
+	 * sqrt(2)*cos(xn) and sqrt(2)*sin(xn) in terms of s=sin(x), c=cos(x):
+	 *
+	 *             n    cos(xn)*sqt2    sin(xn)*sqt2
+	 *          ----------------------------------
+	 *             0     c+s             s-c
+	 *             1     s-c            -c-s
+	 *             2    -c-s            -s+c
+	 *             3    -s+c             c+s
+	 *
+	 * (s+c)*(s-c) = -cos(2x) is used to avoid cancellation.
+	 */
+	s = sin(x);
+	c = cos(x);
+	ss = s+c;
+	cc = s-c;
+	w = -cos(2*x);
+	if (s*c > 0)
+		cc = w/ss;
+	else
+		ss = w/cc;
+	switch ((nm1+1)&3) {
+	case 0: w = ss; ss = cc; cc = w; break;
+	case 1: ss = -ss; break;
+	case 2: w = -ss; ss = -cc; cc = w; break;
+	default:
+	case 3: cc = -cc; break;
+	}
+	/* now cc = sqt2*cos(xn), ss = sqt2*sin(xn) */
+	if (y)
+		*r = invsqrtpi*(p*ss + q*cc)/sqrt(x);
+	else
+		*r = invsqrtpi*(p*cc - q*ss)/sqrt(x);
+	return 1;
+}
+
 double jn(int n, double x)
 {
 	uint32_t ix, lx;
@@ -95,7 +163,7 @@ double jn(int n, double x)
 			case 3: temp =  cos(x)+sin(x); break;
 			}
 			b = invsqrtpi*temp/sqrt(x);
-		} else {
+		} else if (!hankel(nm1, x, &b, 0)) {
 			a = j0(x);
 			b = j1(x);
 			for (i=0; i<nm1; ) {
@@ -264,7 +332,7 @@ double yn(int n, double x)
 		case 3: temp =  sin(x)-cos(x); break;
 		}
 		b = invsqrtpi*temp/sqrt(x);
-	} else {
+	} else if (!hankel(nm1, x, &b, 1)) {
 		a = y0(x);
 		b = y1(x);
 		/* quit if b is -inf */
@@ -0,0 +1,54 @@
+#define _GNU_SOURCE
+#include "libm.h"
+
+void sincospi(double x, double *sin, double *cos)
+{
+	double y[2], s, c;
+	uint32_t ix, lx;
+	unsigned n;
+
+	EXTRACT_WORDS(ix, lx, x);
+	ix &= 0x7fffffff;
+
+	/* sincospi(Inf or NaN) is NaN */
+	if (ix >= 0x7ff00000) {
+		*sin = *cos = x - x;
+		return;
+	}
+	/* |x| >= 2**52 is an integer */
+	if (ix >= 0x43300000) {
+		*sin = 0*x;
+		*cos = ix < 0x43400000 && lx&1 ? -1.0 : 1.0;
+		return;
+	}
+
+	/* One reduction for both results */
+	n = __rem_pi(x, y);
+	if (y[0] == 0) {
+		/* sinpi(+-n) = +-0, cospi(n+1/2) = +0 */
+		*sin = n&1 ? (n&2 ? -1.0 : 1.0) : 0*x;
+		*cos = n&1 ? 0.0 : (n&2 ? -1.0 : 1.0);
+		return;
+	}
+	s = __sin(y[0], y[1], 1);
+	c = __cos(y[0], y[1]);
+	switch (n&3) {
+	case 0:
+		*sin = s;
+		*cos = c;
+		break;
+	case 1:
+		*sin = c;
+		*cos = -s;
+		break;
+	case 2:
+		*sin = -s;
+		*cos = -c;
+		break;
+	case 3:
+	default:
+		*sin = -c;
+		*cos = s;
+		break;
+	}
+}
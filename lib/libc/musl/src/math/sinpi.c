@@ -0,0 +1,32 @@
+#define _GNU_SOURCE
+#include "libm.h"
+
+/* sin(pi*x) without the Payne-Hanek path: the reduction is exact */
+
+double sinpi(double x)
+{
+	double y[2];
+	uint32_t ix;
+	unsigned n;
+
+	GET_HIGH_WORD(ix, x);
+	ix &= 0x7fffffff;
+
+	/* sinpi(Inf or NaN) is NaN */
+	if (ix >= 0x7ff00000)
+		return x - x;
+	/* |x| >= 2**52 is an integer, sinpi(+-n) = +-0 */
+	if (ix >= 0x43300000)
+		return 0*x;
+
+	n = __rem_pi(x, y);
+	if (y[0] == 0 && !(n&1))
+		return 0*x;
+	switch (n&3) {
+	case 0: return  __sin(y[0], y[1], 1);
+	case 1: return  __cos(y[0], y[1]);
+	case 2: return -__sin(y[0], y[1], 1);
+	default:
+		return -__cos(y[0], y[1]);
+	}
+}
@@ -0,0 +1,62 @@
+/*
+ * Array form of expf.
+ *
+ * Each block of input is first scanned for values outside the fast-path
+ * range. Blocks without any are evaluated with the branch-free main path
+ * of expf, which the compiler can vectorize; the rare blocks that do
+ * contain special values go through the scalar function instead. Blocks
+ * are small enough to stay in cache between the scan and the evaluation.
+ * y may be the same array as x.
+ */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "libm.h"
+#include "exp2f_data.h"
+
+#define N (1 << EXP2F_TABLE_BITS)
+#define InvLn2N __exp2f_data.invln2_scaled
+#define T __exp2f_data.tab
+#define C __exp2f_data.poly_scaled
+#define SHIFT __exp2f_data.shift
+#define BLOCK 256
+
+static inline uint32_t top12(float x)
+{
+	return asuint(x) >> 20;
+}
+
+void vexpf(float *y, const float *x, size_t n)
+{
+	uint64_t ki, t;
+	double_t kd, z, r, r2, p, s;
+	size_t i, m;
+	int special;
+
+	for (; n; x+=m, y+=m, n-=m) {
+		m = n < BLOCK ? n : BLOCK;
+		for (special=0, i=0; i<m; i++)
+			special |= (top12(x[i]) & 0x7ff) >= top12(88.0f);
+		if (predict_false(special)) {
+			for (i=0; i<m; i++) y[i] = expf(x[i]);
+			continue;
+		}
+		for (i=0; i<m; i++) {
+			z = InvLn2N * (double_t)x[i];
+			kd = eval_as_double(z + SHIFT);
+			ki = asuint64(kd);
+			kd -= SHIFT;
+			r = z - kd;
+			t = T[ki % N];
+			t += ki << (52 - EXP2F_TABLE_BITS);
+			s = asdouble(t);
+			z = C[0] * r + C[1];
+			r2 = r * r;
+			p = C[2] * r + 1;
+			p = z * r2 + p;
+			y[i] = eval_as_float(p * s);
+		}
+	}
+}
@@ -0,0 +1,61 @@
+/*
+ * Array form of logf.
+ *
+ * Works block by block like vexpf: a block is evaluated with the
+ * branch-free main path of logf unless it contains zero, negative,
+ * subnormal, infinite or nan inputs (or exactly 1, whose sign of zero
+ * depends on the rounding mode), in which case the scalar function is
+ * used for that block. y may be the same array as x.
+ */
+
+#define _GNU_SOURCE
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "libm.h"
+#include "logf_data.h"
+
+#define T __logf_data.tab
+#define A __logf_data.poly
+#define Ln2 __logf_data.ln2
+#define N (1 << LOGF_TABLE_BITS)
+#define OFF 0x3f330000
+#define BLOCK 256
+
+void vlogf(float *y, const float *x, size_t n)
+{
+	double_t z, r, r2, p, p0, invc, logc;
+	uint32_t ix, iz, tmp;
+	size_t i, m;
+	int k, j, special;
+
+	for (; n; x+=m, y+=m, n-=m) {
+		m = n < BLOCK ? n : BLOCK;
+		for (special=0, i=0; i<m; i++) {
+			ix = asuint(x[i]);
+			special |= ix - 0x00800000 >= 0x7f800000 - 0x00800000;
+			special |= WANT_ROUNDING && ix == 0x3f800000;
+		}
+		if (predict_false(special)) {
+			for (i=0; i<m; i++) y[i] = logf(x[i]);
+			continue;
+		}
+		for (i=0; i<m; i++) {
+			ix = asuint(x[i]);
+			tmp = ix - OFF;
+			j = (tmp >> (23 - LOGF_TABLE_BITS)) % N;
+			k = (int32_t)tmp >> 23;
+			iz = ix - (tmp & 0x1ff << 23);
+			invc = T[j].invc;
+			logc = T[j].logc;
+			z = (double_t)asfloat(iz);
+			r = z * invc - 1;
+			p0 = logc + (double_t)k * Ln2;
+			r2 = r * r;
+			p = A[1] * r + A[2];
+			p = A[0] * r2 + p;
+			p = p * r2 + (p0 + r);
+			y[i] = eval_as_float(p);
+		}
+	}
+}
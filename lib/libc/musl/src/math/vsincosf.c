@@ -0,0 +1,18 @@
+#define _GNU_SOURCE
+#include <math.h>
+#include <stddef.h>
+
+/* Array form of sincosf. Each element shares one argument reduction
+ * between its sine and cosine. Either output may be the same array as
+ * x. */
+
+void vsincosf(float *s, float *c, const float *x, size_t n)
+{
+	size_t i;
+	float t;
+
+	for (i=0; i<n; i++) {
+		t = x[i];
+		sincosf(t, s+i, c+i);
+	}
+}
@@ -0,0 +1 @@
+#include "../x86_64/fma.c"
@@ -0,0 +1,36 @@
+#include <math.h>
+
+#if __FMA__
+
+double fma(double x, double y, double z)
+{
+	__asm__ ("vfmadd132sd %1, %2, %0" : "+x" (x) : "x" (y), "x" (z));
+	return x;
+}
+
+#elif __FMA4__
+
+double fma(double x, double y, double z)
+{
+	__asm__ ("vfmaddsd %3, %2, %1, %0" : "=x" (x) : "x" (x), "x" (y), "x" (z));
+	return x;
+}
+
+#else
+
+hidden double __fma_soft(double, double, double);
+
+#define fma __fma_soft
+#include "../fma.c"
+#undef fma
+
+#include "fma_hw.h"
+
+double fma(double x, double y, double z)
+{
+	if (!fma_hw()) return __fma_soft(x, y, z);
+	__asm__ ("vfmadd132sd %1, %2, %0" : "+x" (x) : "x" (y), "x" (z));
+	return x;
+}
+
+#endif
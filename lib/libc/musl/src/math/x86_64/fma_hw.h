@@ -0,0 +1,23 @@
+/* Baseline builds cannot assume FMA, but most machines they run on
+ * have it, and the software fallback is far slower. Check once at
+ * runtime: the FMA and AVX cpuid bits, and that the kernel saves ymm
+ * state (OSXSAVE and XCR0 bits 1-2). */
+
+static int have_fma(void)
+{
+	unsigned a, b, c, d;
+	__asm__ ("cpuid" : "=a"(a), "=b"(b), "=c"(c), "=d"(d) : "a"(1), "c"(0));
+	if ((c & (1<<12 | 1<<27 | 1<<28)) != (1<<12 | 1<<27 | 1<<28))
+		return 0;
+	__asm__ ("xgetbv" : "=a"(a), "=d"(d) : "c"(0));
+	return (a & 6) == 6;
+}
+
+static volatile signed char hw;
+
+static inline int fma_hw(void)
+{
+	int h = hw;
+	if (!h) hw = h = have_fma() ? 1 : -1;
+	return h > 0;
+}
@@ -0,0 +1,36 @@
+#include <math.h>
+
+#if __FMA__
+
+float fmaf(float x, float y, float z)
+{
+	__asm__ ("vfmadd132ss %1, %2, %0" : "+x" (x) : "x" (y), "x" (z));
+	return x;
+}
+
+#elif __FMA4__
+
+float fmaf(float x, float y, float z)
+{
+	__asm__ ("vfmaddss %3, %2, %1, %0" : "=x" (x) : "x" (x), "x" (y), "x" (z));
+	return x;
+}
+
+#else
+
+hidden float __fmaf_soft(float, float, float);
+
+#define fmaf __fmaf_soft
+#include "../fmaf.c"
+#undef fmaf
+
+#include "fma_hw.h"
+
+float fmaf(float x, float y, float z)
+{
+	if (!fma_hw()) return __fmaf_soft(x, y, z);
+	__asm__ ("vfmadd132ss %1, %2, %0" : "+x" (x) : "x" (y), "x" (z));
+	return x;
+}
+
+#endif
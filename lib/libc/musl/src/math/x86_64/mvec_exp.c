@@ -0,0 +1,209 @@
+/*
+ * Vector variants of exp, exp2, expf and exp2f following the x86_64
+ * vector function ABI (libmvec _ZGV names), for use by vectorized loops.
+ *
+ * The lanes use the same table-driven algorithms and data as the scalar
+ * functions, without the scalar special-case branches. Lanes whose input
+ * is outside the fast-path range (tiny, huge, inf or nan) are recomputed
+ * with the scalar function afterwards. Accuracy is that of the scalar
+ * algorithms; as with other vector math libraries, errno is not set and
+ * floating-point exception flags may differ from the scalar functions.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include "libm.h"
+#include "exp_data.h"
+#include "exp2f_data.h"
+
+#define N (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_data.invln2N
+#define NegLn2hiN __exp_data.negln2hiN
+#define NegLn2loN __exp_data.negln2loN
+#define Shift __exp_data.shift
+#define T __exp_data.tab
+#define C2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define C3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define C4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define C5 __exp_data.poly[8 - EXP_POLY_ORDER]
+#define Exp2Shift __exp_data.exp2_shift
+#define E2C1 __exp_data.exp2_poly[0]
+#define E2C2 __exp_data.exp2_poly[1]
+#define E2C3 __exp_data.exp2_poly[2]
+#define E2C4 __exp_data.exp2_poly[3]
+#define E2C5 __exp_data.exp2_poly[4]
+
+#define NF (1 << EXP2F_TABLE_BITS)
+#define InvLn2NF __exp2f_data.invln2_scaled
+#define ShiftF __exp2f_data.shift
+#define ShiftScaledF __exp2f_data.shift_scaled
+#define TF __exp2f_data.tab
+#define CF __exp2f_data.poly
+#define CSF __exp2f_data.poly_scaled
+
+#define MAXLANES 16
+
+/* Top 12 bits of a double (sign and exponent bits).  */
+static inline uint32_t top12(double x)
+{
+	return asuint64(x) >> 52;
+}
+
+/* Top 12 bits of the float representation with the sign bit cleared.  */
+static inline uint32_t abstop12f(float x)
+{
+	return asuint(x) >> 20 & 0x7ff;
+}
+
+static inline int exp_special(double x)
+{
+	return (top12(x) & 0x7ff) - top12(0x1p-54) >= top12(512.0) - top12(0x1p-54);
+}
+
+static inline void vexp_lanes(double *y, const double *x, int n)
+{
+	uint64_t ki, idx, top, sbits;
+	double_t kd, z, r, r2, tail, tmp, scale;
+	int i, special = 0;
+
+	for (i=0; i<n; i++) {
+		special |= exp_special(x[i]);
+		z = InvLn2N * x[i];
+		kd = eval_as_double(z + Shift);
+		ki = asuint64(kd);
+		kd -= Shift;
+		r = x[i] + kd * NegLn2hiN + kd * NegLn2loN;
+		idx = 2 * (ki % N);
+		top = ki << (52 - EXP_TABLE_BITS);
+		tail = asdouble(T[idx]);
+		sbits = T[idx + 1] + top;
+		r2 = r * r;
+		tmp = tail + r + r2 * (C2 + r * C3) + r2 * r2 * (C4 + r * C5);
+		scale = asdouble(sbits);
+		y[i] = eval_as_double(scale + scale * tmp);
+	}
+	if (predict_false(special))
+		for (i=0; i<n; i++)
+			if (exp_special(x[i])) y[i] = exp(x[i]);
+}
+
+static inline void vexp2_lanes(double *y, const double *x, int n)
+{
+	uint64_t ki, idx, top, sbits;
+	double_t kd, r, r2, tail, tmp, scale;
+	int i, special = 0;
+
+	for (i=0; i<n; i++) {
+		special |= exp_special(x[i]);
+		kd = eval_as_double(x[i] + Exp2Shift);
+		ki = asuint64(kd);
+		kd -= Exp2Shift;
+		r = x[i] - kd;
+		idx = 2 * (ki % N);
+		top = ki << (52 - EXP_TABLE_BITS);
+		tail = asdouble(T[idx]);
+		sbits = T[idx + 1] + top;
+		r2 = r * r;
+		tmp = tail + r * E2C1 + r2 * (E2C2 + r * E2C3) + r2 * r2 * (E2C4 + r * E2C5);
+		scale = asdouble(sbits);
+		y[i] = eval_as_double(scale + scale * tmp);
+	}
+	if (predict_false(special))
+		for (i=0; i<n; i++)
+			if (exp_special(x[i])) y[i] = exp2(x[i]);
+}
+
+static inline void vexpf_lanes(float *y, const float *x, int n)
+{
+	uint64_t ki, t;
+	double_t kd, z, r, r2, s, p;
+	int i, special = 0;
+
+	for (i=0; i<n; i++) {
+		special |= abstop12f(x[i]) >= abstop12f(88.0f);
+		z = InvLn2NF * (double_t)x[i];
+		kd = eval_as_double(z + ShiftF);
+		ki = asuint64(kd);
+		kd -= ShiftF;
+		r = z - kd;
+		t = TF[ki % NF];
+		t += ki << (52 - EXP2F_TABLE_BITS);
+		s = asdouble(t);
+		z = CSF[0] * r + CSF[1];
+		r2 = r * r;
+		p = CSF[2] * r + 1;
+		p = z * r2 + p;
+		y[i] = eval_as_float(p * s);
+	}
+	if (predict_false(special))
+		for (i=0; i<n; i++)
+			if (abstop12f(x[i]) >= abstop12f(88.0f)) y[i] = expf(x[i]);
+}
+
+static inline void vexp2f_lanes(float *y, const float *x, int n)
+{
+	uint64_t ki, t;
+	double_t kd, z, r, r2, s, p;
+	int i, special = 0;
+
+	for (i=0; i<n; i++) {
+		special |= abstop12f(x[i]) >= abstop12f(128.0f);
+		kd = eval_as_double((double_t)x[i] + ShiftScaledF);
+		ki = asuint64(kd);
+		kd -= ShiftScaledF;
+		r = (double_t)x[i] - kd;
+		t = TF[ki % NF];
+		t += ki << (52 - EXP2F_TABLE_BITS);
+		s = asdouble(t);
+		z = CF[0] * r + CF[1];
+		r2 = r * r;
+		p = CF[2] * r + 1;
+		p = z * r2 + p;
+		y[i] = eval_as_float(p * s);
+	}
+	if (predict_false(special))
+		for (i=0; i<n; i++)
+			if (abstop12f(x[i]) >= abstop12f(128.0f)) y[i] = exp2f(x[i]);
+}
+
+typedef double vd2 __attribute__((__vector_size__(16)));
+typedef double vd4 __attribute__((__vector_size__(32)));
+typedef double vd8 __attribute__((__vector_size__(64)));
+typedef float vf4 __attribute__((__vector_size__(16)));
+typedef float vf8 __attribute__((__vector_size__(32)));
+typedef float vf16 __attribute__((__vector_size__(64)));
+
+/* ISA letters: b = SSE2 (xmm), c = AVX (ymm), d = AVX2 (ymm),
+ * e = AVX-512 (zmm). The lane count follows from the register width. */
+
+#define VEC(name, isa, vt, st, n, kernel) \
+__attribute__((__target__(isa))) vt name(vt x) \
+{ \
+	st a[MAXLANES], b[MAXLANES]; \
+	vt y; \
+	memcpy(a, &x, sizeof x); \
+	kernel(b, a, n); \
+	memcpy(&y, b, sizeof y); \
+	return y; \
+}
+
+VEC(_ZGVbN2v_exp, "sse2", vd2, double, 2, vexp_lanes)
+VEC(_ZGVcN4v_exp, "avx", vd4, double, 4, vexp_lanes)
+VEC(_ZGVdN4v_exp, "avx2,fma", vd4, double, 4, vexp_lanes)
+VEC(_ZGVeN8v_exp, "avx512f", vd8, double, 8, vexp_lanes)
+
+VEC(_ZGVbN2v_exp2, "sse2", vd2, double, 2, vexp2_lanes)
+VEC(_ZGVcN4v_exp2, "avx", vd4, double, 4, vexp2_lanes)
+VEC(_ZGVdN4v_exp2, "avx2,fma", vd4, double, 4, vexp2_lanes)
+VEC(_ZGVeN8v_exp2, "avx512f", vd8, double, 8, vexp2_lanes)
+
+VEC(_ZGVbN4v_expf, "sse2", vf4, float, 4, vexpf_lanes)
+VEC(_ZGVcN8v_expf, "avx", vf8, float, 8, vexpf_lanes)
+VEC(_ZGVdN8v_expf, "avx2,fma", vf8, float, 8, vexpf_lanes)
+VEC(_ZGVeN16v_expf, "avx512f", vf16, float, 16, vexpf_lanes)
+
+VEC(_ZGVbN4v_exp2f, "sse2", vf4, float, 4, vexp2f_lanes)
+VEC(_ZGVcN8v_exp2f, "avx", vf8, float, 8, vexp2f_lanes)
+VEC(_ZGVdN8v_exp2f, "avx2,fma", vf8, float, 8, vexp2f_lanes)
+VEC(_ZGVeN16v_exp2f, "avx512f", vf16, float, 16, vexp2f_lanes)
@@ -15,6 +15,7 @@ weak_alias(dummy_lockptr, __locale_lockptr);
 weak_alias(dummy_lockptr, __random_lockptr);
 weak_alias(dummy_lockptr, __sem_open_lockptr);
 weak_alias(dummy_lockptr, __stdio_ofl_lockptr);
+weak_alias(dummy_lockptr, __stdio_popen_lockptr);
 weak_alias(dummy_lockptr, __syslog_lockptr);
 weak_alias(dummy_lockptr, __timezone_lockptr);
 weak_alias(dummy_lockptr, __bump_lockptr);
@@ -30,6 +31,7 @@ static volatile int *const *const atfork_locks[] = {
 	&__random_lockptr,
 	&__sem_open_lockptr,
 	&__stdio_ofl_lockptr,
+	&__stdio_popen_lockptr,
 	&__syslog_lockptr,
 	&__timezone_lockptr,
 	&__bump_lockptr,
@@ -0,0 +1,71 @@
+#define _GNU_SOURCE
+#include "stdio_impl.h"
+#include <sys/uio.h>
+
+/* Write a sequence of records to f. Batches that fit in the buffer are
+ * copied there as usual; larger ones are handed to the kernel with
+ * writev, together with any pending buffered data, without being
+ * copied through f->buf first. Records go out in windows of at most
+ * WINDOW-1 entries to keep the stack frame small. */
+
+#define WINDOW 64
+
+static size_t fwritev_direct(FILE *f, const struct iovec *iov, int iovcnt)
+{
+	struct iovec v[WINDOW], *p;
+	size_t done = 0;
+	ssize_t r;
+	int cnt;
+
+	v[0].iov_base = f->wbase;
+	v[0].iov_len = f->wpos - f->wbase;
+	while (iovcnt) {
+		for (cnt=1; cnt<WINDOW && iovcnt; cnt++, iov++, iovcnt--)
+			v[cnt] = *iov;
+		for (p=v; ; ) {
+			r = syscall(SYS_writev, f->fd, p, cnt);
+			if (r < 0) {
+				f->wpos = f->wbase = f->wend = 0;
+				f->flags |= F_ERR;
+				return done;
+			}
+			for (; cnt && r >= p->iov_len; p++, cnt--) {
+				r -= p->iov_len;
+				if (p != v) done += p->iov_len;
+			}
+			if (!cnt) break;
+			p->iov_base = (char *)p->iov_base + r;
+			p->iov_len -= r;
+			if (p != v) done += r;
+		}
+		/* Later windows carry no buffered data. */
+		v[0].iov_len = 0;
+	}
+	f->wend = f->buf + f->buf_size;
+	f->wpos = f->wbase = f->buf;
+	return done;
+}
+
+size_t fwritev(FILE *restrict f, const struct iovec *iov, int iovcnt)
+{
+	size_t total = 0, done = 0, l;
+	int i;
+
+	if (iovcnt < 0) return 0;
+	for (i=0; i<iovcnt; i++) total += iov[i].iov_len;
+
+	FLOCK(f);
+	if (!f->wend && __towrite(f)) {
+		FUNLOCK(f);
+		return 0;
+	}
+	if (f->write == __stdio_write && total > f->wend - f->wpos) {
+		done = fwritev_direct(f, iov, iovcnt);
+	} else for (i=0; i<iovcnt; i++) {
+		l = __fwritex(iov[i].iov_base, iov[i].iov_len, f);
+		done += l;
+		if (l < iov[i].iov_len) break;
+	}
+	FUNLOCK(f);
+	return done;
+}
@@ -6,9 +6,38 @@
 #include <spawn.h>
 #include "stdio_impl.h"
 #include "syscall.h"
+#include "lock.h"
+#include "fork_impl.h"
 
 extern char **__environ;
 
+/* Pipe streams are kept on their own list, so that the fds the child
+ * must close can be found without walking every open FILE. */
+
+static volatile int lock[1];
+volatile int *const __stdio_popen_lockptr = lock;
+static FILE *pipe_head;
+
+static int pipe_close(FILE *);
+
+/* Also called by freopen before it replaces the close hook. */
+void __popen_unlink(FILE *f)
+{
+	if (f->close != pipe_close) return;
+	LOCK(lock);
+	if (f->pipe_prev) f->pipe_prev->pipe_next = f->pipe_next;
+	else pipe_head = f->pipe_next;
+	if (f->pipe_next) f->pipe_next->pipe_prev = f->pipe_prev;
+	f->pipe_prev = f->pipe_next = 0;
+	UNLOCK(lock);
+}
+
+static int pipe_close(FILE *f)
+{
+	__popen_unlink(f);
+	return __stdio_close(f);
+}
+
 FILE *popen(const char *cmd, const char *mode)
 {
 	int p[2], op, e;
@@ -35,23 +64,28 @@ FILE *popen(const char *cmd, const char *mode)
 
 	e = ENOMEM;
 	if (!posix_spawn_file_actions_init(&fa)) {
-		for (FILE *l = *__ofl_lock(); l; l=l->next)
-			if (l->pipe_pid && posix_spawn_file_actions_addclose(&fa, l->fd))
+		LOCK(lock);
+		for (FILE *l = pipe_head; l; l=l->pipe_next)
+			if (posix_spawn_file_actions_addclose(&fa, l->fd))
 				goto fail;
 		if (!posix_spawn_file_actions_adddup2(&fa, p[1-op], 1-op)) {
 			if (!(e = posix_spawn(&pid, "/bin/sh", &fa, 0,
 			    (char *[]){ "sh", "-c", (char *)cmd, 0 }, __environ))) {
 				posix_spawn_file_actions_destroy(&fa);
 				f->pipe_pid = pid;
+				f->close = pipe_close;
+				f->pipe_next = pipe_head;
+				if (pipe_head) pipe_head->pipe_prev = f;
+				pipe_head = f;
 				if (!strchr(mode, 'e'))
 					fcntl(p[op], F_SETFD, 0);
 				__syscall(SYS_close, p[1-op]);
-				__ofl_unlock();
+				UNLOCK(lock);
 				return f;
 			}
 		}
 fail:
-		__ofl_unlock();
+		UNLOCK(lock);
 		posix_spawn_file_actions_destroy(&fa);
 	}
 	fclose(f);
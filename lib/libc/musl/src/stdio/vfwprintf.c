@@ -129,6 +129,56 @@ static void out(FILE *f, const wchar_t *s, size_t l)
 	while (l-- && !(f->flags & F_ERR)) fputwc(*s++, f);
 }
 
+static void pad(FILE *f, wchar_t c, int w, int l, int fl)
+{
+	if (fl & (LEFT_ADJ | ZERO_PAD) || l >= w) return;
+	for (l = w - l; l > 0 && !(f->flags & F_ERR); l--) fputwc(c, f);
+}
+
+static const char xdigits[16] = {
+	"0123456789ABCDEF"
+};
+
+/* Decimal digit pairs, so that integer conversion retires two digits
+ * per division rather than one. */
+
+static const char dpairs[200] = {
+	"00010203040506070809" "10111213141516171819"
+	"20212223242526272829" "30313233343536373839"
+	"40414243444546474849" "50515253545556575859"
+	"60616263646566676869" "70717273747576777879"
+	"80818283848586878889" "90919293949596979899"
+};
+
+static wchar_t *fmt_x(uintmax_t x, wchar_t *s, int lower)
+{
+	for (; x; x>>=4) *--s = xdigits[(x&15)]|lower;
+	return s;
+}
+
+static wchar_t *fmt_o(uintmax_t x, wchar_t *s)
+{
+	for (; x; x>>=3) *--s = '0' + (x&7);
+	return s;
+}
+
+static wchar_t *fmt_u(uintmax_t x, wchar_t *s)
+{
+	unsigned long y;
+	for (   ; x>ULONG_MAX; x/=100) {
+		s -= 2;
+		s[0] = dpairs[2*(x%100)];
+		s[1] = dpairs[2*(x%100)+1];
+	}
+	for (y=x; y>=10; y/=100) {
+		s -= 2;
+		s[0] = dpairs[2*(y%100)];
+		s[1] = dpairs[2*(y%100)+1];
+	}
+	if (y) *--s = '0' + y;
+	return s;
+}
+
 static int getint(wchar_t **s) {
 	int i;
 	for (i=0; iswdigit(**s); (*s)++) {
@@ -140,8 +190,6 @@ static int getint(wchar_t **s) {
 
 static const char sizeprefix['y'-'a'] = {
 ['a'-'a']='L', ['e'-'a']='L', ['f'-'a']='L', ['g'-'a']='L',
-['d'-'a']='j', ['i'-'a']='j', ['o'-'a']='j', ['u'-'a']='j', ['x'-'a']='j',
-['p'-'a']='j'
 };
 
 static int wprintf_core(FILE *f, const wchar_t *fmt, va_list *ap, union arg *nl_arg, int *nl_type)
@@ -158,6 +206,9 @@ static int wprintf_core(FILE *f, const wchar_t *fmt, va_list *ap, union arg *nl_
 	char *bs;
 	char charfmt[16];
 	wchar_t wc;
+	wchar_t buf[sizeof(uintmax_t)*3];
+	const wchar_t *prefix;
+	int pl;
 
 	for (;;) {
 		/* This error is only specified for snprintf, but since it's
@@ -303,22 +354,76 @@ static int wprintf_core(FILE *f, const wchar_t *fmt, va_list *ap, union arg *nl_
 		}
 
 		if (xp && p<0) goto overflow;
-		snprintf(charfmt, sizeof charfmt, "%%%s%s%s%s%s*.*%c%c",
-			"#"+!(fl & ALT_FORM),
-			"+"+!(fl & MARK_POS),
-			"-"+!(fl & LEFT_ADJ),
-			" "+!(fl & PAD_POS),
-			"0"+!(fl & ZERO_PAD),
-			sizeprefix[(t|32)-'a'], t);
 
 		switch (t|32) {
 		case 'a': case 'e': case 'f': case 'g':
+			snprintf(charfmt, sizeof charfmt, "%%%s%s%s%s%s*.*%c%c",
+				"#"+!(fl & ALT_FORM),
+				"+"+!(fl & MARK_POS),
+				"-"+!(fl & LEFT_ADJ),
+				" "+!(fl & PAD_POS),
+				"0"+!(fl & ZERO_PAD),
+				sizeprefix[(t|32)-'a'], t);
 			l = fprintf(f, charfmt, w, p, arg.f);
-			break;
-		case 'd': case 'i': case 'o': case 'u': case 'x': case 'p':
-			l = fprintf(f, charfmt, w, p, arg.i);
+			continue;
+		}
+
+		/* - and 0 flags are mutually exclusive */
+		if (fl & LEFT_ADJ) fl &= ~ZERO_PAD;
+
+		/* Integer conversions are formatted directly into wide
+		 * characters rather than round-tripping through fprintf. */
+		a = z = buf + sizeof buf/sizeof *buf;
+		prefix = L"-+   0X0x";
+		pl = 0;
+
+		switch (t) {
+		case 'p':
+			if (xp && p < 2*(int)sizeof(void*)) p = 2*sizeof(void*);
+			t = 'x';
+			fl |= ALT_FORM;
+		case 'x': case 'X':
+			a = fmt_x(arg.i, z, t&32);
+			if (arg.i && (fl & ALT_FORM)) prefix+=(t>>4), pl=2;
+			if (0) {
+		case 'o':
+			a = fmt_o(arg.i, z);
+			if ((fl&ALT_FORM) && p<z-a+1) p=z-a+1;
+			} if (0) {
+		case 'd': case 'i':
+			pl=1;
+			if (arg.i>INTMAX_MAX) {
+				arg.i=-arg.i;
+			} else if (fl & MARK_POS) {
+				prefix++;
+			} else if (fl & PAD_POS) {
+				prefix+=2;
+			} else pl=0;
+		case 'u':
+			a = fmt_u(arg.i, z);
+			}
+			if (xp) fl &= ~ZERO_PAD;
+			if (!arg.i && !p) {
+				a=z;
+				break;
+			}
+			if (p < z-a + !arg.i) p = z-a + !arg.i;
 			break;
 		}
+
+		if (p < z-a) p = z-a;
+		if (p > INT_MAX-pl) goto overflow;
+		if (w < pl+p) w = pl+p;
+		if (w > INT_MAX-cnt) goto overflow;
+
+		pad(f, ' ', w, pl+p, fl);
+		out(f, prefix, pl);
+		pad(f, '0', w, pl+p, fl^ZERO_PAD);
+		pad(f, '0', p, z-a, 0);
+		out(f, a, z-a);
+		pad(f, ' ', w, pl+p, fl^LEFT_ADJ);
+
+		l = w;
 	}
 
 	if (f) return cnt;
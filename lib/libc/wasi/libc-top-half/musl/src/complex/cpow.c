@@ -2,7 +2,60 @@
 
 /* pow(z, c) = exp(c log(z)), See C99 G.6.4.1 */
 
+/*
+ * For integral c and finite nonzero z, z**c is computed by repeated
+ * squaring: this takes at most 2*17 complex multiplies and is exact
+ * where the exponential form is not (e.g. (1+I)**2 = 2I). Its error
+ * still grows roughly linearly with |c|, as in the exponential form.
+ * 0 is returned, and the general formula used, if the result is not
+ * finite or |z**|c|| < 0x1p-510, where intermediate results may have
+ * lost precision to underflow.
+ */
+static int ipow(double complex *r, double complex z, int n)
+{
+	double a, b, x, y, t;
+	unsigned k;
+
+	a = creal(z);
+	b = cimag(z);
+	x = 1;
+	y = 0;
+	k = n < 0 ? -(unsigned)n : n;
+	for (;;) {
+		if (k & 1) {
+			t = x*a - y*b;
+			y = x*b + y*a;
+			x = t;
+		}
+		if (!(k >>= 1))
+			break;
+		t = a*a - b*b;
+		b = 2*a*b;
+		a = t;
+	}
+	t = x*x + y*y;
+	if (!(t >= 0x1p-1020))
+		return 0;
+	if (n < 0) {
+		if (t == INFINITY)
+			return 0;
+		x = x/t;
+		y = -y/t;
+	}
+	if (!isfinite(x) || !isfinite(y))
+		return 0;
+	*r = CMPLX(x, y);
+	return 1;
+}
+
 double complex cpow(double complex z, double complex c)
 {
+	double complex r;
+	double n = creal(c);
+
+	if (cimag(c) == 0 && fabs(n) <= 0x1p16 && n == (int)n &&
+	    isfinite(creal(z)) && isfinite(cimag(z)) && z != 0 &&
+	    ipow(&r, z, n))
+		return r;
 	return cexp(c * clog(z));
 }
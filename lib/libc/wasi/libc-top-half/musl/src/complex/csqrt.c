@@ -75,6 +75,13 @@ double complex csqrt(double complex z)
 	 * the normal code path below.
 	 */
 
+	/* Real z needs neither scaling nor hypot. */
+	if (b == 0) {
+		if (a >= 0)
+			return CMPLX(sqrt(a), b);
+		return CMPLX(0, copysign(sqrt(-a), b));
+	}
+
 	/* Scale to avoid overflow. */
 	if (fabs(a) >= THRESH || fabs(b) >= THRESH) {
 		a *= 0.25;
@@ -3,15 +3,32 @@
 
 static size_t wstring_read(FILE *f, unsigned char *buf, size_t len)
 {
-	const wchar_t *src = f->cookie;
-	size_t k;
+	const wchar_t *src = f->cookie, *t;
+	size_t k, l;
 
 	if (!src) return 0;
 
-	k = wcsrtombs((void *)f->buf, &src, f->buf_size, 0);
-	if (k==(size_t)-1) {
-		f->rpos = f->rend = 0;
-		return 0;
+	/* Numeric input is almost entirely ASCII; narrow runs of it
+	 * directly and leave only the remainder to wcsrtombs. */
+	for (k=0; k<f->buf_size && (unsigned)*src-1 < 0x7f; k++)
+		f->buf[k] = *src++;
+
+	if (!*src) {
+		src = 0;
+	} else if (k < f->buf_size) {
+		t = src;
+		l = wcsrtombs((void *)(f->buf+k), &src, f->buf_size-k, 0);
+		if (l==(size_t)-1) {
+			if (!k) {
+				f->rpos = f->rend = 0;
+				return 0;
+			}
+			/* Deliver what was narrowed; the error is
+			 * reported on the next read. */
+			src = t;
+			l = 0;
+		}
+		k += l;
 	}
 
 	f->rpos = f->buf;
@@ -41,6 +41,32 @@ static int __futex4_cp(volatile void *addr, int op, int val, const struct timesp
 }
 #endif
 
+/* Before sleeping, spin briefly in case the waker is about to act. This
+ * applies to every __timedwait caller (locks, cond, join, semaphores).
+ * The spin budget is learned per futex address (hashed into a small
+ * table) from how long recent successful spins took; a spin that runs
+ * out halves the estimate, so waits on long-held futexes fall back to
+ * the minimum budget. The slot is only written when the estimate
+ * changes, so a settled estimate costs no cache-line traffic between
+ * waiters. Races on the estimate are harmless. */
+
+#define SPIN_SLOTS 64
+#define SPIN_MAX 100
+
+static volatile int spin_est[SPIN_SLOTS];
+
+static int spin_wait(volatile int *addr, int val)
+{
+	volatile int *est = spin_est + (uintptr_t)addr/sizeof *addr % SPIN_SLOTS;
+	int cnt, e = *est, n, max = 2*e + 10;
+
+	if (max > SPIN_MAX) max = SPIN_MAX;
+	for (cnt=0; cnt<max && *addr==val; cnt++) a_spin();
+	n = cnt < max ? e + (cnt - e) / 8 : e / 2;
+	if (n != e) *est = n;
+	return cnt < max;
+}
+
 int __timedwait_cp(volatile int *addr, int val,
 	clockid_t clk, const struct timespec *at, int priv)
 {
@@ -61,6 +87,8 @@ int __timedwait_cp(volatile int *addr, int val,
 		top = &to;
 	}
 
+	if (spin_wait(addr, val)) return 0;
+
 	r = -__futex4_cp(addr, FUTEX_WAIT|priv, val, top);
 	if (r != EINTR && r != ETIMEDOUT && r != ECANCELED) r = 0;
 #ifdef __wasilibc_unmodified_upstream
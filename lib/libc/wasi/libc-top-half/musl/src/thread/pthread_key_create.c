@@ -9,6 +9,10 @@ static pthread_rwlock_t key_lock = PTHREAD_RWLOCK_INITIALIZER;
 
 static pthread_key_t next_key;
 
+/* One past the highest key in use, so that thread exit only scans the
+ * part of the table that can hold values. */
+static int key_limit;
+
 static void nodtor(void *dummy)
 {
 }
@@ -36,6 +40,7 @@ int __pthread_key_create(pthread_key_t *k, void (*dtor)(void *))
 	do {
 		if (!keys[j]) {
 			keys[next_key = *k = j] = dtor;
+			if (j >= key_limit) key_limit = j+1;
 			__pthread_rwlock_unlock(&key_lock);
 			return 0;
 		}
@@ -61,6 +66,7 @@ int __pthread_key_delete(pthread_key_t k)
 	__tl_unlock();
 
 	keys[k] = 0;
+	while (key_limit && !keys[key_limit-1]) key_limit--;
 
 	__pthread_rwlock_unlock(&key_lock);
 #ifdef __wasilibc_unmodified_upstream
@@ -77,7 +83,7 @@ void __pthread_tsd_run_dtors()
 	for (j=0; self->tsd_used && j<PTHREAD_DESTRUCTOR_ITERATIONS; j++) {
 		__pthread_rwlock_rdlock(&key_lock);
 		self->tsd_used = 0;
-		for (i=0; i<PTHREAD_KEYS_MAX; i++) {
+		for (i=0; i<key_limit; i++) {
 			void *val = self->tsd[i];
 			void (*dtor)(void *) = keys[i];
 			self->tsd[i] = 0;